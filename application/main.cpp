@@ -1,16 +1,42 @@
 #include "simulator\simulator.h"
 #include "rw2_group6\rw2_group6.h"
+#include <chrono>
+#include <iostream>
 #include <memory>
+#include <string>
+#include <thread>
 
-int main(){
-    auto solver = std::make_unique<rw2group6::Algorithm>();
+int main(int argc, char* argv[]){
+    auto solver = std::make_unique<rw2group6::Algorithm>(Simulator::mazeWidth(),Simulator::mazeHeight());
+    // optional arguments: --async to plan in a separate thread, --lazy to sense
+    // walls only when needed, --shortcut to cut across explored cells, and a
+    // file to keep the local map between launches
+    std::string map_file;
+    for(int i{1};i<argc;i++){
+        std::string arg{argv[i]};
+        if(arg=="--async")solver->set_async(true);
+        else if(arg=="--lazy")solver->set_lazy_sensing(true);
+        else if(arg=="--shortcut")solver->set_shortcuts(true);
+        else map_file = arg;
+    }
     // initialize
     solver->init_maze();
-    solver->generate_goal();    
+    if(map_file.empty() || !solver->load_map(map_file)){
+        solver->generate_goal();
+    }
 
-    // get mouse to goal location
-    solver->follow_wall("right");
+    while(true){
+        // get mouse to goal location and back to the initial location
+        solver->run("right");
+        if(!map_file.empty())solver->save_map(map_file);
 
-    // go back to initial location
-    solver->return_to_init_loc();
+        // wait for the reset button, the local map is kept for the next run.
+        // a reset pressed during a run is only seen here, after the run
+        while(!Simulator::wasReset()){
+            if(!std::cin)return 0; // the simulator closed the connection
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        }
+        Simulator::ackReset();
+        solver->reset_run();
+    }
 }
@@ -0,0 +1,104 @@
+#include "maze.h"
+#include <fstream>
+
+rw2group6::Maze::Maze(int width, int height):
+    m_width{width},m_height{height},
+    m_wall(static_cast<std::size_t>(width)*height,std::array<bool,4>{false,false,false,false}){
+    for(int x{0};x<m_width;x++){
+        set_wall(x,0,2,true);
+        set_wall(x,m_height-1,0,true);
+    }
+    for(int y{0};y<m_height;y++){
+        set_wall(0,y,3,true);
+        set_wall(m_width-1,y,1,true);
+    }
+}
+
+bool rw2group6::Maze::load(const std::string& file_name){
+    std::ifstream file(file_name);
+    if(!file)return false;
+    // keep the rows of the maze drawing, stop at the first other line
+    std::vector<std::string> rows;
+    std::string row;
+    while(std::getline(file,row)){
+        if(!row.empty() && row.back()=='\r')row.pop_back();
+        if(row.empty() || (row[0]!='o' && row[0]!='|'))break;
+        rows.push_back(row);
+    }
+    if(rows.size()<3 || rows.size()%2==0 || rows[0].size()<5 || (rows[0].size()-1)%4!=0)return false;
+    int width{static_cast<int>(rows[0].size()-1)/4};
+    int height{static_cast<int>(rows.size()-1)/2};
+    for(const auto& r : rows){
+        if(static_cast<int>(r.size())!=4*width+1)return false;
+    }
+    *this = Maze(width,height);
+    for(int y{0};y<m_height;y++){
+        // rows are drawn from the top (north) down
+        int r{2*(m_height-1-y)+1};
+        for(int x{0};x<m_width;x++){
+            if(rows[r-1][4*x+1]=='-')set_wall(x,y,0,true);
+            if(rows[r+1][4*x+1]=='-')set_wall(x,y,2,true);
+            if(rows[r][4*x]=='|')set_wall(x,y,3,true);
+            if(rows[r][4*x+4]=='|')set_wall(x,y,1,true);
+            if(rows[r][4*x+2]=='G')m_goals.push_back({x,y});
+        }
+    }
+    return true;
+}
+
+bool rw2group6::Maze::save(const std::string& file_name) const{
+    std::ofstream file(file_name);
+    if(!file)return false;
+    std::vector<std::string> rows(2*m_height+1,std::string(4*m_width+1,' '));
+    for(int y{0};y<m_height;y++){
+        int r{2*(m_height-1-y)+1};
+        for(int x{0};x<m_width;x++){
+            rows[r-1][4*x] = rows[r-1][4*x+4] = 'o';
+            rows[r+1][4*x] = rows[r+1][4*x+4] = 'o';
+            if(is_wall(x,y,0))rows[r-1].replace(4*x+1,3,"---");
+            if(is_wall(x,y,2))rows[r+1].replace(4*x+1,3,"---");
+            if(is_wall(x,y,3))rows[r][4*x] = '|';
+            if(is_wall(x,y,1))rows[r][4*x+4] = '|';
+        }
+    }
+    rows[2*m_height-1][2] = 'S';
+    for(const auto& [x,y] : m_goals){
+        rows[2*(m_height-1-y)+1][4*x+2] = 'G';
+    }
+    for(const auto& r : rows){
+        file << r << "\n";
+    }
+    return static_cast<bool>(file);
+}
+
+int rw2group6::Maze::get_width() const{
+    return m_width;
+}
+
+int rw2group6::Maze::get_height() const{
+    return m_height;
+}
+
+bool rw2group6::Maze::is_wall(int x, int y, int dir) const{
+    return m_wall[static_cast<std::size_t>(y)*m_width+x].at(dir);
+}
+
+void rw2group6::Maze::set_wall(int x, int y, int dir, bool wall){
+    std::array<int,4> dir_x{0,1,0,-1};
+    std::array<int,4> dir_y{1,0,-1,0};
+    m_wall[static_cast<std::size_t>(y)*m_width+x].at(dir) = wall;
+    // the same wall seen from the neighbor cell
+    int x_{x+dir_x.at(dir)};
+    int y_{y+dir_y.at(dir)};
+    if(x_>=0 && x_<m_width && y_>=0 && y_<m_height){
+        m_wall[static_cast<std::size_t>(y_)*m_width+x_].at((dir+2)%4) = wall;
+    }
+}
+
+const std::vector<std::pair<int,int>>& rw2group6::Maze::get_goals() const{
+    return m_goals;
+}
+
+void rw2group6::Maze::set_goals(const std::vector<std::pair<int,int>>& goals){
+    m_goals = goals;
+}
@@ -0,0 +1,104 @@
+#ifndef __MAZE_H__
+#define __MAZE_H__
+#include <array>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief maze stored in the mazefiles text format
+ * (posts 'o', horizontal walls '---', vertical walls '|')
+ */
+#pragma once
+namespace rw2group6{
+
+class Maze{
+    public:
+    /**
+     * @brief Construct a new Maze object with the outer walls
+     * and no inner walls
+     * 
+     * @param width number of cells along x
+     * @param height number of cells along y
+     */
+    Maze(int width = 16, int height = 16);
+    /**
+     * @brief read a maze in the mazefiles text format
+     * 
+     * @param file_name path of the maze file
+     * @return true if the file was read and is well formed
+     */
+    bool load(const std::string& file_name);
+    /**
+     * @brief write the maze in the mazefiles text format, with the
+     * start 'S' at (0,0) and the goal cells marked 'G'
+     * 
+     * @param file_name path of the maze file
+     * @return true if the file was written
+     */
+    bool save(const std::string& file_name) const;
+    /**
+     * @brief Get the width of the maze
+     * 
+     * @return number of cells along x
+     */
+    int get_width() const;
+    /**
+     * @brief Get the height of the maze
+     * 
+     * @return number of cells along y
+     */
+    int get_height() const;
+    /**
+     * @brief query whether a wall exists around a cell
+     * 
+     * @param x x coordinate of the cell
+     * @param y y coordinate of the cell
+     * @param dir absolute direction (0-3, mapped from n/e/s/w)
+     * @return true if there is a wall
+     */
+    bool is_wall(int x, int y, int dir) const;
+    /**
+     * @brief set or remove a wall, on both sides of the wall
+     * 
+     * @param x x coordinate of the cell
+     * @param y y coordinate of the cell
+     * @param dir absolute direction (0-3, mapped from n/e/s/w)
+     * @param wall true to set the wall, false to remove it
+     */
+    void set_wall(int x, int y, int dir, bool wall);
+    /**
+     * @brief Get the goal cells marked 'G' in the file
+     * 
+     * @return goal cells as (x,y)
+     */
+    const std::vector<std::pair<int,int>>& get_goals() const;
+    /**
+     * @brief Set the goal cells to be marked 'G' when saving
+     * 
+     * @param goals goal cells as (x,y)
+     */
+    void set_goals(const std::vector<std::pair<int,int>>& goals);
+
+    private:
+    /**
+     * @brief m_width is the number of cells along x
+     */
+    int m_width;
+    /**
+     * @brief m_height is the number of cells along y
+     */
+    int m_height;
+    /**
+     * @brief m_wall stores the n/e/s/w walls of each cell, row by row
+     * starting from y=0
+     */
+    std::vector<std::array<bool,4>> m_wall;
+    /**
+     * @brief m_goals stores the goal cells
+     */
+    std::vector<std::pair<int,int>> m_goals;
+}; // class Maze
+
+} // namespace rw2group6
+#endif
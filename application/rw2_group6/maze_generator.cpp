@@ -0,0 +1,66 @@
+#include "maze_generator.h"
+#include <array>
+#include <vector>
+
+rw2group6::Maze rw2group6::MazeGenerator::generate(int width, int height, double loop_density, double straightness){
+    std::array<int,4> dir_x{0,1,0,-1};
+    std::array<int,4> dir_y{1,0,-1,0};
+    Maze maze(width,height);
+    // start with every inner wall
+    for(int y{0};y<height;y++){
+        for(int x{0};x<width;x++){
+            maze.set_wall(x,y,1,true);
+            maze.set_wall(x,y,0,true);
+        }
+    }
+    std::uniform_real_distribution<> chance(0.0,1.0);
+    // randomized depth-first search from (0,0), with an explicit stack
+    // so that large mazes do not overflow the call stack
+    std::vector<char> visited(static_cast<std::size_t>(width)*height,0);
+    std::vector<std::array<int,3>> stack; // x, y, direction of the last carve
+    stack.push_back({0,0,0});
+    visited[0] = 1;
+    std::vector<int> candidates;
+    while(!stack.empty()){
+        auto [x,y,last_dir] = stack.back();
+        candidates.clear();
+        for(int d{0};d<4;d++){
+            int x_{x+dir_x.at(d)};
+            int y_{y+dir_y.at(d)};
+            if(x_<0 || x_>=width || y_<0 || y_>=height)continue;
+            if(visited[static_cast<std::size_t>(y_)*width+x_])continue;
+            candidates.push_back(d);
+        }
+        if(candidates.empty()){
+            stack.pop_back();
+            continue;
+        }
+        int d{};
+        bool can_go_straight{false};
+        for(int c : candidates){
+            if(c==last_dir)can_go_straight = true;
+        }
+        if(can_go_straight && chance(m_gen)<straightness){
+            d = last_dir;
+        }else{
+            std::uniform_int_distribution<std::size_t> pick(0,candidates.size()-1);
+            d = candidates[pick(m_gen)];
+        }
+        maze.set_wall(x,y,d,false);
+        int x_{x+dir_x.at(d)};
+        int y_{y+dir_y.at(d)};
+        visited[static_cast<std::size_t>(y_)*width+x_] = 1;
+        stack.push_back({x_,y_,d});
+    }
+    // open loops by removing some of the remaining inner walls
+    if(loop_density>0.0){
+        for(int y{0};y<height;y++){
+            for(int x{0};x<width;x++){
+                if(x<width-1 && maze.is_wall(x,y,1) && chance(m_gen)<loop_density)maze.set_wall(x,y,1,false);
+                if(y<height-1 && maze.is_wall(x,y,0) && chance(m_gen)<loop_density)maze.set_wall(x,y,0,false);
+            }
+        }
+    }
+    maze.set_goals({{width-1,height-1}});
+    return maze;
+}
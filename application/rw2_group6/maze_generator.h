@@ -0,0 +1,45 @@
+#ifndef __MAZE_GENERATOR_H__
+#define __MAZE_GENERATOR_H__
+#include <random>
+#include "maze.h"
+
+/**
+ * @brief seeded generator of mazes of any size, used to benchmark the
+ * solver on mazes larger than the mazefiles corpus
+ */
+#pragma once
+namespace rw2group6{
+
+class MazeGenerator{
+    public:
+    /**
+     * @brief Construct a new MazeGenerator object
+     * 
+     * @param seed seed of the random number generator, the same seed
+     * gives the same mazes
+     */
+    MazeGenerator(unsigned int seed): m_gen{seed}{};
+    /**
+     * @brief generate a maze: a perfect maze (randomized depth-first
+     * search) with some inner walls removed afterwards to add loops.
+     * the goal is marked at (width-1,height-1)
+     * 
+     * @param width number of cells along x
+     * @param height number of cells along y
+     * @param loop_density probability (0-1) to remove each remaining inner
+     * wall, 0 gives a perfect maze
+     * @param straightness probability (0-1) to keep carving in the same
+     * direction when possible, higher values give longer corridors
+     * @return the generated maze
+     */
+    Maze generate(int width, int height, double loop_density = 0.0, double straightness = 0.5);
+
+    private:
+    /**
+     * @brief m_gen is the random number generator
+     */
+    std::mt19937 m_gen;
+}; // class MazeGenerator
+
+} // namespace rw2group6
+#endif
@@ -0,0 +1,116 @@
+#include "maze_symmetry.h"
+#include <utility>
+#include <vector>
+
+std::pair<int,int> rw2group6::MazeSymmetry::map_cell(int t, int x, int y, int width, int height){
+    if(is_mirror(t))x = width-1-x;
+    for(int r{0};r<t%4;r++){
+        // rotate clockwise by 90 deg, width and height swap
+        int x_{y};
+        y = width-1-x;
+        x = x_;
+        std::swap(width,height);
+    }
+    return {x,y};
+}
+
+int rw2group6::MazeSymmetry::map_dir(int t, int dir){
+    if(is_mirror(t))dir = (4-dir)%4; // swap east and west
+    return (dir+t%4)%4;
+}
+
+bool rw2group6::MazeSymmetry::is_mirror(int t){
+    return t>=4;
+}
+
+std::string rw2group6::MazeSymmetry::encode(const Maze& maze, int t){
+    int width{maze.get_width()};
+    int height{maze.get_height()};
+    int width_{t%2==0 ? width : height};
+    int height_{t%2==0 ? height : width};
+    // n/e/s/w walls of every cell after the symmetry as 4 bits
+    std::vector<char> walls(static_cast<std::size_t>(width_)*height_,0);
+    for(int y{0};y<height;y++){
+        for(int x{0};x<width;x++){
+            auto [x_,y_] = map_cell(t,x,y,width,height);
+            char& cell{walls[static_cast<std::size_t>(y_)*width_+x_]};
+            for(int d{0};d<4;d++){
+                if(maze.is_wall(x,y,d))cell |= static_cast<char>(1<<map_dir(t,d));
+            }
+        }
+    }
+    std::string encoding{std::to_string(width_)+" "+std::to_string(height_)+"|"};
+    encoding.reserve(encoding.size()+walls.size());
+    for(char cell : walls){
+        encoding.push_back(static_cast<char>('a'+cell));
+    }
+    return encoding;
+}
+
+std::string rw2group6::MazeSymmetry::canonical_maze(const Maze& maze){
+    std::string canonical{encode(maze,0)};
+    for(int t{1};t<m_count;t++){
+        std::string encoding{encode(maze,t)};
+        if(encoding<canonical)canonical = std::move(encoding);
+    }
+    return canonical;
+}
+
+std::string rw2group6::MazeSymmetry::canonical_case(const Maze& maze, int start_x, int start_y, int start_dir,
+        int goal_x, int goal_y, const std::string& left_right_follow){
+    int width{maze.get_width()};
+    int height{maze.get_height()};
+    std::string canonical;
+    for(int t{0};t<m_count;t++){
+        auto [sx,sy] = map_cell(t,start_x,start_y,width,height);
+        auto [gx,gy] = map_cell(t,goal_x,goal_y,width,height);
+        // a mirrored maze is solved the same way with the other rule
+        bool left{(left_right_follow=="left")!=is_mirror(t)};
+        // in a corner, two sides are outer walls. facing into the maze either
+        // way the rule checks the two open sides in the same order, so both
+        // headings are encoded the same, e.g., north and east at (0,0)
+        int sd{map_dir(t,start_dir)};
+        int width_{t%2==0 ? width : height};
+        int height_{t%2==0 ? height : width};
+        bool corner{(sx==0 || sx==width_-1) && (sy==0 || sy==height_-1)};
+        bool inward{(sd==0 && sy<height_-1) || (sd==1 && sx<width_-1) || (sd==2 && sy>0) || (sd==3 && sx>0)};
+        std::string heading{corner && inward ? "in" : std::to_string(sd)};
+        std::string encoding{encode(maze,t)};
+        encoding += "|"+std::to_string(sx)+" "+std::to_string(sy)+" "+heading
+            +"|"+std::to_string(gx)+" "+std::to_string(gy)+"|"+(left ? "left" : "right");
+        if(t==0 || encoding<canonical)canonical = std::move(encoding);
+    }
+    return canonical;
+}
+
+std::uint64_t rw2group6::MazeSymmetry::hash(const std::string& encoding){
+    std::uint64_t h{14695981039346656037ULL};
+    for(char c : encoding){
+        h ^= static_cast<unsigned char>(c);
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+bool rw2group6::SolveCache::find(const std::string& key, SolveResult& result){
+    auto it = m_results.find(key);
+    if(it==m_results.end()){
+        m_misses++;
+        return false;
+    }
+    m_hits++;
+    result = it->second;
+    return true;
+}
+
+void rw2group6::SolveCache::insert(const std::string& key, const SolveResult& result){
+    m_results[key] = result;
+}
+
+int rw2group6::SolveCache::get_hits(){
+    return m_hits;
+}
+
+int rw2group6::SolveCache::get_misses(){
+    return m_misses;
+}
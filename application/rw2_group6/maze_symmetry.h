@@ -0,0 +1,155 @@
+#ifndef __MAZE_SYMMETRY_H__
+#define __MAZE_SYMMETRY_H__
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include "maze.h"
+
+/**
+ * @brief canonical forms of mazes under the 8 symmetries of the square
+ * (4 rotations, each with or without a mirror), used to detect mazes and
+ * solver cases that are rotations/mirrors of each other
+ */
+#pragma once
+namespace rw2group6{
+
+class MazeSymmetry{
+    public:
+    /**
+     * @brief number of symmetries: 0-3 rotate clockwise by 0/90/180/270 deg,
+     * 4-7 mirror along x first, then rotate the same way
+     */
+    static const int m_count{8};
+    /**
+     * @brief map a cell through a symmetry
+     * 
+     * @param t symmetry (0-7)
+     * @param x x coordinate of the cell
+     * @param y y coordinate of the cell
+     * @param width width of the maze before the symmetry
+     * @param height height of the maze before the symmetry
+     * @return the (x,y) coordinate after the symmetry
+     */
+    static std::pair<int,int> map_cell(int t, int x, int y, int width, int height);
+    /**
+     * @brief map an absolute direction through a symmetry
+     * 
+     * @param t symmetry (0-7)
+     * @param dir absolute direction (0-3, mapped from n/e/s/w)
+     * @return absolute direction after the symmetry
+     */
+    static int map_dir(int t, int dir);
+    /**
+     * @brief whether a symmetry mirrors the maze, which swaps
+     * left and right wall following
+     */
+    static bool is_mirror(int t);
+    /**
+     * @brief encode the walls of the maze after a symmetry
+     * 
+     * @param maze the maze
+     * @param t symmetry (0-7)
+     * @return size and walls of every cell as a string
+     */
+    static std::string encode(const Maze& maze, int t);
+    /**
+     * @brief the smallest encoding of the maze among the 8 symmetries,
+     * equal for mazes that are rotations/mirrors of each other
+     */
+    static std::string canonical_maze(const Maze& maze);
+    /**
+     * @brief the smallest encoding of a solver case among the 8 symmetries,
+     * with the start pose, the goal and the left/right rule remapped with
+     * the walls. cases with the same encoding give the same number of moves
+     * and wall queries. in a corner, both headings into the maze are encoded
+     * the same (e.g., north and east at (0,0)) since they make the same moves,
+     * so a maze and its transpose (mirror along the diagonal) share their cases
+     * 
+     * @param maze the maze
+     * @param start_x x coordinate of the start location
+     * @param start_y y coordinate of the start location
+     * @param start_dir start direction of the mouse (0-3, mapped from n/e/s/w)
+     * @param goal_x x coordinate of the goal location
+     * @param goal_y y coordinate of the goal location
+     * @param left_right_follow the wall following rule: left/right
+     */
+    static std::string canonical_case(const Maze& maze, int start_x, int start_y, int start_dir,
+        int goal_x, int goal_y, const std::string& left_right_follow);
+    /**
+     * @brief 64-bit FNV-1a hash of an encoding
+     */
+    static std::uint64_t hash(const std::string& encoding);
+}; // class MazeSymmetry
+
+/**
+ * @brief result of the solver for one case
+ */
+struct SolveResult{
+    /**
+     * @brief true if the goal was reached
+     */
+    bool reached;
+    /**
+     * @brief number of moves to the goal
+     */
+    int moves;
+    /**
+     * @brief number of wall queries sent to the simulator on the way to the goal
+     */
+    int wall_queries;
+    /**
+     * @brief number of wall queries of the whole run: to the goal and
+     * back to (0,0) with return_to_init_loc()
+     */
+    int run_wall_queries;
+};
+
+class SolveCache{
+    public:
+    /**
+     * @brief Construct an empty SolveCache object
+     */
+    SolveCache(): m_hits{0},m_misses{0}{};
+    /**
+     * @brief look up the result of a case
+     * 
+     * @param key canonical encoding of the case (MazeSymmetry::canonical_case)
+     * @param result set to the cached result if found
+     * @return true if the case was already solved
+     */
+    bool find(const std::string& key, SolveResult& result);
+    /**
+     * @brief store the result of a case
+     * 
+     * @param key canonical encoding of the case (MazeSymmetry::canonical_case)
+     * @param result result of the solver
+     */
+    void insert(const std::string& key, const SolveResult& result);
+    /**
+     * @brief Get the number of lookups that found a result
+     */
+    int get_hits();
+    /**
+     * @brief Get the number of lookups that did not find a result
+     */
+    int get_misses();
+
+    private:
+    /**
+     * @brief m_results maps the canonical encoding of a case to its result.
+     * the full encoding is the key, so different cases never collide
+     */
+    std::unordered_map<std::string,SolveResult> m_results;
+    /**
+     * @brief m_hits is the number of lookups that found a result
+     */
+    int m_hits;
+    /**
+     * @brief m_misses is the number of lookups that did not find a result
+     */
+    int m_misses;
+}; // class SolveCache
+
+} // namespace rw2group6
+#endif
@@ -6,6 +6,13 @@
 #include <iostream>
 #include <ctime>
 #include <string>
+#include <queue>
+#include <algorithm>
+#include <fstream>
+#include <thread>
+#include <chrono>
+#include <functional>
+#include <stdexcept>
 void rw2group6::Mouse::turn(int dir_offset){
     if(dir_offset==-1)turn_left();
     else if(dir_offset==1)turn_right();
@@ -50,6 +57,16 @@ int rw2group6::Mouse::get_y(){
 int rw2group6::Mouse::get_moves(){
     return m_moves;
 }
+
+void rw2group6::Mouse::set_moves(int moves){
+    m_moves = moves;
+}
+
+void rw2group6::Mouse::reset_pose(){
+    m_curr_loc_x = 0;
+    m_curr_loc_y = 0;
+    m_curr_dir = Algorithm::dir2int('n');
+}
 int rw2group6::Cell::is_wall(int dir){
     return m_wall.at(dir);
 }
@@ -86,17 +103,26 @@ const int rw2group6::Algorithm::dir2int(char dir){
         return dir2intmap[dir];
 }
 std::string rw2group6::Algorithm::int2dir = "nesw";
+const std::array<int,4> rw2group6::Algorithm::dir_x{0,1,0,-1};
+const std::array<int,4> rw2group6::Algorithm::dir_y{1,0,-1,0};
+
+int rw2group6::Algorithm::rule2first_dir(const std::string& left_right_follow){
+    if(left_right_follow=="left")return -1;
+    return 1;
+}
 
 void rw2group6::Algorithm::generate_goal(){
     std::random_device rd; // obtain a random number from hardware
     std::mt19937 gen(rd()); // seed the generator
     std::uniform_int_distribution<> distr(0, m_maze_width-1); // define the range
+    std::uniform_int_distribution<> distr_y(0, m_maze_height-1); // range along the left/right walls
     std::uniform_int_distribution<> distr2(0, 3); // define the range
     while(1){
         // first decide which wall to put the goal
         int pos{distr(gen)};
         std::srand(std::time(0));
         int i{distr2(gen)};
+        if(i==0 || i==2)pos = distr_y(gen);
         if(i==0){ // left wall
             if(pos!=0){ // not at origin
                 m_goal_x = 0;
@@ -125,6 +151,11 @@ void rw2group6::Algorithm::generate_goal(){
     // color the goal position
     Simulator::setColor(m_goal_x,m_goal_y,'w');
 }
+void rw2group6::Algorithm::set_goal(int x, int y){
+    m_goal_x = x;
+    m_goal_y = y;
+    Simulator::setColor(m_goal_x,m_goal_y,'w');
+}
 int rw2group6::Algorithm::calculate_dir(int dir,int flr){
     int d_{dir + flr};
     if(d_<0)d_+=4;
@@ -147,6 +178,10 @@ bool rw2group6::Algorithm::check_wall(int lfr){
     // calculate absolute direction
     int d_{Algorithm::calculate_dir(d,lfr)};
     int check_{m_maze[y][x].is_wall(d_)};
+    if(check_==-1 && m_lazy_sensing){
+        // only sense the wall now that the decision needs it
+        return sense_wall(d,x,y,lfr);
+    }
     bool check_result{};
     if(check_==1) {
         check_result = true;
@@ -156,6 +191,30 @@ bool rw2group6::Algorithm::check_wall(int lfr){
     return check_result;
 }
 
+bool rw2group6::Algorithm::sense_wall(int curr_dir, int x, int y, int lfr){
+    int d_{calculate_dir(curr_dir,lfr)};
+    bool check_result{};
+    switch (lfr)
+    {
+    case 0:
+        check_result = Simulator::wallFront();
+        break;
+    case -1:
+        check_result = Simulator::wallLeft();
+        break;
+    case 1:
+        check_result = Simulator::wallRight();
+        break;
+    }
+    m_wall_queries++;
+    // save check result in cell (local map)
+    store_wall(x,y,d_,check_result);
+    // set wall color in the simulation
+    if(check_result==1)
+        Simulator::setWall(x,y,int2dir.at(d_));
+    return check_result;
+}
+
 void rw2group6::Algorithm::detect_wall_lfr(int curr_dir, int x, int y){
     // this function ensures the wall information for the 
     // current cell is stored in the local map for the left, 
@@ -164,70 +223,63 @@ void rw2group6::Algorithm::detect_wall_lfr(int curr_dir, int x, int y){
     for(int d : dirs){ // go through all 3 directions
         // see if the local map has the information
         int d_{calculate_dir(curr_dir,d)}; 
-        bool check_result{}; // check if local map has the information
-        
         if(m_maze[y][x].is_wall(d_)==-1){ // no data availabe in the local map, query simulator
-            switch (d)
-            {
-            case 0:
-                check_result = Simulator::wallFront();
-                break;
-            case -1:
-                check_result = Simulator::wallLeft();
-                break;
-            case 1:
-                check_result = Simulator::wallRight();
-                break;
-            }
-            // save check result in cell (local map)
-            m_maze[y][x].set_wall(d_,check_result);
-            // set wall color in the simulation
-            if(check_result==1)
-                Simulator::setWall(x,y,int2dir.at(d_));
+            sense_wall(curr_dir,x,y,d);
         }
     }
 }
 void rw2group6::Algorithm::follow_wall(std::string left_right_follow){
-    int do_move{};
     char color{'c'}; // the color to fill the path taken
-    int first_dir{}; // the first direction to check changes based on left/right wall following
-    if(left_right_follow=="left")first_dir = -1;
-    else first_dir = 1;
+    // the first direction to check changes based on left/right wall following
+    int first_dir{rule2first_dir(left_right_follow)};
     // detect left, front and right wall at the (0,0) location
-    detect_wall_lfr(m_mouse.get_dir(),m_mouse.get_x(),m_mouse.get_y());
+    // (with lazy sensing check_wall() senses each wall when it is needed)
+    if(!m_lazy_sensing)detect_wall_lfr(m_mouse.get_dir(),m_mouse.get_x(),m_mouse.get_y());
     while(m_mouse.get_x()!=m_goal_x || m_mouse.get_y()!=m_goal_y){
-        do_move = 1; // flag indicating whether to move to a new location, default is to move
-        // store wall information in the local map first
-        int dir{m_mouse.get_dir()};
         // update first vist record
         update_first_vist();
-        if(!check_wall(first_dir)){ 
-            m_mouse.turn(first_dir);
-        }else if(!check_wall(0)){ // 0  is front
-            // do nothing
-        }else if(!check_wall(-first_dir)){  // check the opposite direction of first_dir
-            m_mouse.turn(-first_dir);
-        }else{
-            // turn around
-            m_mouse.turn(2);
-            do_move = 0;
-        }
-        if(do_move){
-            m_mouse.move_forward(color);
-            // just move to the new location, we can immediately update the 
-            // wall behind us, because there can't be any wall 
-            update_back_wall(false);
-            // at a new location, detect any wall to the left, front and right 
-            // if the information is not in the local map
-            detect_wall_lfr(m_mouse.get_dir(),m_mouse.get_x(),m_mouse.get_y());
-        }
+        follow_wall_step(first_dir,color);
     }
     update_first_vist();
 }
 
+int rw2group6::Algorithm::follow_turn(int first_dir, const std::function<int(int)>& wall){
+    // check first_dir, then the front, then the opposite direction of first_dir
+    for(int lfr : {first_dir,0,-first_dir}){
+        int wall_{wall(lfr)};
+        if(wall_==-1)return -2; // the decision needs an unknown wall
+        if(wall_==0)return lfr;
+    }
+    return 2; // turn around
+}
+
+void rw2group6::Algorithm::follow_wall_step(int first_dir, char color){
+    int turn{follow_turn(first_dir,[this](int lfr){return static_cast<int>(check_wall(lfr));})};
+    m_mouse.turn(turn);
+    if(turn!=2){ // move to a new location unless the mouse turned around
+        m_mouse.move_forward(color);
+        // just move to the new location, we can immediately update the 
+        // wall behind us, because there can't be any wall 
+        update_back_wall(false);
+        // at a new location, detect any wall to the left, front and right 
+        // if the information is not in the local map
+        if(!m_lazy_sensing)detect_wall_lfr(m_mouse.get_dir(),m_mouse.get_x(),m_mouse.get_y());
+    }
+}
+
+void rw2group6::Algorithm::store_wall(int x, int y, int dir, bool is_wall){
+    m_maze[y][x].set_wall(dir,is_wall);
+    // the neighbor cell shares the same wall
+    int x_{x+dir_x.at(dir)};
+    int y_{y+dir_y.at(dir)};
+    if(x_>=0 && x_<m_maze_width && y_>=0 && y_<m_maze_height){
+        m_maze[y_][x_].set_wall(calculate_dir(dir,2),is_wall);
+    }
+}
+
 void rw2group6::Algorithm::update_back_wall(bool is_wall){
     int dir_offset{2}; // the direction offset for turning around
-    m_maze[m_mouse.get_y()][m_mouse.get_x()].set_wall(calculate_dir(m_mouse.get_dir(),dir_offset),is_wall);
+    store_wall(m_mouse.get_x(),m_mouse.get_y(),calculate_dir(m_mouse.get_dir(),dir_offset),is_wall);
 }
 
 void rw2group6::Algorithm::return_to_init_loc(){
@@ -239,46 +291,419 @@ void rw2group6::Algorithm::return_to_init_loc(){
     Simulator::clearAllColor();
     int x{m_mouse.get_x()};
     int y{m_mouse.get_y()};
-    std::array<int,4> dir_x{0,1,0,-1};
-    std::array<int,4> dir_y{1,0,-1,0};
-    std::array<int,3> lfr{-1,0,1};
-    // first turn around
-    m_mouse.turn(2); 
     char color = 'o';
     Simulator::setColor(x,y,color);
-    int early_visit{};
-    int dir_next{};
+    // on later runs the goal may be reached from any side, e.g., along a known
+    // path, so the first visit records are not ordered along the way back.
+    // take the shortest known path instead
+    std::vector<int> path;
+    if(m_runs>1 && plan_known_path(0,0,path)){
+        for(int d : path)move_to_dir(d,color);
+        return;
+    }
     while(x!=0 || y!=0){
-        early_visit = -1;
-        for(int d : lfr){
-            if(check_wall(d)==1)continue; // 1 means there is a wall
-            // calculate direction relative to the current direction of the mouse
-            int d_{calculate_dir(m_mouse.get_dir(),d)}; 
+        // every location was first reached from a location visited earlier,
+        // so one of the 4 has an earlier visit than the current location
+        int early_visit{m_first_visit[y][x]};
+        int dir_next{-1};
+        for(int d{0};d<4;d++){
             // compute x, y coordinate in that direction
-            int x_{x+dir_x.at(d_)};
-            int y_{y+dir_y.at(d_)};
+            int x_{x+dir_x.at(d)};
+            int y_{y+dir_y.at(d)};
             if(x_>=0 && x_<m_maze_width && y_>=0 && y_<m_maze_height){ // if within maze
-                if(y_==0 && x_==0 ){ // if found (0,0), break out of the loop
+                // skip locations not visited before looking at the wall
+                bool origin{y_==0 && x_==0};
+                if(!origin && m_first_visit[y_][x_]==0)continue; // not visited
+                // only go through passages known to be open, an unknown wall may be there
+                if(!is_known_open(x,y,d))continue;
+                if(origin){ // if found (0,0), break out of the loop
                     dir_next = d;
                     break;
                 }
-                if(m_first_visit[y_][x_]==0)continue; // not visited
-                if(early_visit==-1){ // find the earliest visit among all adjacent and reachable locations
-                    early_visit=m_first_visit[y_][x_];
+                if(m_first_visit[y_][x_]<early_visit){ // find the earliest visit among all adjacent and reachable locations
+                    early_visit = m_first_visit[y_][x_];
                     dir_next = d;
-                } else {
-                    if(m_first_visit[y_][x_]<early_visit){
-                        early_visit = m_first_visit[y_][x_];
-                        dir_next = d;
-                    }
                 }
             }
         }
+        if(dir_next==-1){
+            // never move without a known open passage
+            std::cerr << "no way back to (0,0) from (" << x << "," << y << ")\n";
+            return;
+        }
         // now go according to dir_next
-        m_mouse.turn(dir_next);
-        m_mouse.move_forward(color);
+        move_to_dir(dir_next,color);
         // get the new location
         x = m_mouse.get_x();
         y = m_mouse.get_y();
     }
 }
+
+void rw2group6::Algorithm::run(std::string left_right_follow){
+    m_runs++;
+    int queries{m_wall_queries};
+    int moves{m_mouse.get_moves()};
+    // on later runs the local map may already know a route to the goal
+    try{
+        if(!follow_known_path()){
+            if(m_shortcuts)follow_wall_shortcut(left_right_follow);
+            else if(m_async)follow_wall_async(left_right_follow);
+            else follow_wall(left_right_follow);
+        }
+    }catch(const std::runtime_error& e){
+        // e.g., wall following goes around in circles and never reaches the goal
+        std::cerr << "run " << m_runs << ": goal (" << m_goal_x << "," << m_goal_y
+                  << ") not reached: " << e.what() << "\n";
+        return;
+    }
+    int moves_to_goal{m_mouse.get_moves()-moves};
+    return_to_init_loc();
+    std::cerr << "run " << m_runs << ": " << moves_to_goal << " moves to goal, "
+              << m_wall_queries-queries << " wall queries";
+    if(m_shortcuts)std::cerr << ", " << m_moves_saved << " moves saved by shortcuts so far";
+    std::cerr << "\n";
+}
+
+void rw2group6::Algorithm::reset_run(){
+    // the simulator puts the mouse back at (0,0) facing north
+    m_mouse.reset_pose();
+    Simulator::clearAllColor();
+    Simulator::setColor(0,0,'c');
+    Simulator::setColor(m_goal_x,m_goal_y,'w');
+}
+
+bool rw2group6::Algorithm::is_known_open(int x, int y, int dir){
+    int x_{x+dir_x.at(dir)};
+    int y_{y+dir_y.at(dir)};
+    if(x_<0 || x_>=m_maze_width || y_<0 || y_>=m_maze_height)return false;
+    // the wall is stored in both cells, either one may hold the information
+    int wall{m_maze[y][x].is_wall(dir)};
+    int wall_{m_maze[y_][x_].is_wall(calculate_dir(dir,2))};
+    if(wall==1 || wall_==1)return false;
+    return wall==0 || wall_==0;
+}
+
+bool rw2group6::Algorithm::plan_known_path(int x_goal, int y_goal, std::vector<int>& path){
+    // direction of the move that first reached each location, -1 if not reached
+    std::vector<std::vector<int>> came_from(m_maze_height,std::vector<int>(m_maze_width,-1));
+    int x{m_mouse.get_x()};
+    int y{m_mouse.get_y()};
+    std::queue<std::pair<int,int>> frontier;
+    frontier.push({x,y});
+    came_from[y][x] = 4; // start location
+    while(!frontier.empty() && came_from[y_goal][x_goal]==-1){
+        auto [x_,y_] = frontier.front();
+        frontier.pop();
+        for(int d{0};d<4;d++){
+            if(!is_known_open(x_,y_,d))continue;
+            int x_next{x_+dir_x.at(d)};
+            int y_next{y_+dir_y.at(d)};
+            if(came_from[y_next][x_next]!=-1)continue;
+            came_from[y_next][x_next] = d;
+            frontier.push({x_next,y_next});
+        }
+    }
+    if(came_from[y_goal][x_goal]==-1)return false;
+    // walk back from the goal to the start
+    path.clear();
+    int x_{x_goal};
+    int y_{y_goal};
+    while(x_!=x || y_!=y){
+        int d{came_from[y_][x_]};
+        path.push_back(d);
+        x_ -= dir_x.at(d);
+        y_ -= dir_y.at(d);
+    }
+    std::reverse(path.begin(),path.end());
+    return true;
+}
+
+bool rw2group6::Algorithm::follow_known_path(){
+    std::vector<int> path;
+    if(!plan_known_path(m_goal_x,m_goal_y,path))return false;
+    char color{'c'};
+    for(int d : path){
+        move_to_dir(d,color);
+        update_back_wall(false);
+        update_first_vist();
+    }
+    return true;
+}
+
+void rw2group6::Algorithm::move_to_dir(int dir, char color){
+    turn_to_dir(dir);
+    m_mouse.move_forward(color);
+}
+
+void rw2group6::Algorithm::turn_to_dir(int dir){
+    // offset from the current direction: 0 front, 1 right, 2 back, 3 left
+    int offset{(dir-m_mouse.get_dir()+4)%4};
+    if(offset==3)offset = -1;
+    m_mouse.turn(offset);
+}
+
+bool rw2group6::Algorithm::save_map(const std::string& file_name){
+    std::ofstream file(file_name);
+    if(!file)return false;
+    file << m_maze_width << " " << m_maze_height << "\n";
+    file << m_goal_x << " " << m_goal_y << " " << m_mouse.get_moves() << "\n";
+    // one line per cell: wall n/e/s/w (-1 unknown, 0 no wall, 1 wall) and first visit
+    for(int y{0};y<m_maze_height;y++){
+        for(int x{0};x<m_maze_width;x++){
+            for(int d{0};d<4;d++){
+                file << m_maze[y][x].is_wall(d) << " ";
+            }
+            file << m_first_visit[y][x] << "\n";
+        }
+    }
+    return static_cast<bool>(file);
+}
+
+bool rw2group6::Algorithm::load_map(const std::string& file_name){
+    std::ifstream file(file_name);
+    if(!file)return false;
+    int width{},height{};
+    file >> width >> height;
+    if(!file || width!=m_maze_width || height!=m_maze_height)return false;
+    int goal_x{},goal_y{},moves{};
+    file >> goal_x >> goal_y >> moves;
+    auto maze{m_maze};
+    auto first_visit{m_first_visit};
+    for(int y{0};y<m_maze_height;y++){
+        for(int x{0};x<m_maze_width;x++){
+            for(int d{0};d<4;d++){
+                int wall{};
+                file >> wall;
+                if(wall!=-1)maze[y][x].set_wall(d,wall);
+            }
+            file >> first_visit[y][x];
+        }
+    }
+    if(!file)return false; // truncated file, keep the current map
+    m_maze = maze;
+    m_first_visit = first_visit;
+    // maps saved before walls were stored on both sides may only know one side
+    for(int y{0};y<m_maze_height;y++){
+        for(int x{0};x<m_maze_width;x++){
+            for(int d{0};d<4;d++){
+                int wall{m_maze[y][x].is_wall(d)};
+                if(wall!=-1)store_wall(x,y,d,wall);
+            }
+        }
+    }
+    m_goal_x = goal_x;
+    m_goal_y = goal_y;
+    m_mouse.set_moves(moves);
+    // draw the known walls and the goal
+    for(int y{0};y<m_maze_height;y++){
+        for(int x{0};x<m_maze_width;x++){
+            for(int d{0};d<4;d++){
+                if(m_maze[y][x].is_wall(d)==1)Simulator::setWall(x,y,int2dir.at(d));
+            }
+        }
+    }
+    Simulator::setColor(m_goal_x,m_goal_y,'w');
+    return true;
+}
+
+std::size_t rw2group6::Algorithm::get_map_bytes(){
+    std::size_t bytes{m_maze.capacity()*sizeof(std::vector<Cell>)
+        +m_first_visit.capacity()*sizeof(std::vector<int>)};
+    for(const auto& row : m_maze)bytes += row.capacity()*sizeof(Cell);
+    for(const auto& row : m_first_visit)bytes += row.capacity()*sizeof(int);
+    return bytes;
+}
+
+void rw2group6::Algorithm::set_async(bool async){
+    m_async = async;
+}
+
+void rw2group6::Algorithm::set_lazy_sensing(bool lazy){
+    m_lazy_sensing = lazy;
+}
+
+void rw2group6::Algorithm::follow_wall_async(std::string left_right_follow){
+    using clock = std::chrono::steady_clock;
+    int first_dir{rule2first_dir(left_right_follow)};
+    SpscQueue<PlanCommand,64> commands;
+    SpscQueue<SenseResult,2> senses;
+    std::atomic<bool> stop{false};
+    double busy_ns{0};
+    double stall_ns{0}; // time the main thread waited for the planner
+    int steps{0};
+    int ready{0}; // steps already planned when the main thread asked for them
+    char color{'c'};
+    std::thread planner(&Algorithm::plan_follow_wall,this,first_dir,
+        m_mouse.get_x(),m_mouse.get_y(),m_mouse.get_dir(),m_mouse.get_moves(),
+        std::ref(commands),std::ref(senses),std::ref(stop),std::ref(busy_ns));
+    try{
+        while(true){
+            PlanCommand command{};
+            auto wait_start = clock::now();
+            if(commands.pop(command)){
+                ready++;
+            }else{
+                Backoff backoff;
+                while(!commands.pop(command))backoff.pause();
+                stall_ns += std::chrono::duration<double,std::nano>(clock::now()-wait_start).count();
+            }
+            steps++;
+            if(command.type==PlanStep::done)break;
+            if(command.type==PlanStep::turn){
+                m_mouse.turn(command.value);
+            }else if(command.type==PlanStep::move){
+                m_mouse.move_forward(color);
+            }else if(command.type==PlanStep::sense){
+                SenseResult result{{-1,-1,-1}};
+                for(int i{0};i<3;i++){ // left, front, right
+                    if(!(command.value>>i & 1))continue;
+                    if(i==0)result.walls[i] = Simulator::wallLeft();
+                    else if(i==1)result.walls[i] = Simulator::wallFront();
+                    else result.walls[i] = Simulator::wallRight();
+                    m_wall_queries++;
+                    if(result.walls[i]==1)
+                        Simulator::setWall(m_mouse.get_x(),m_mouse.get_y(),int2dir.at(calculate_dir(m_mouse.get_dir(),i-1)));
+                }
+                Backoff backoff;
+                while(!senses.push(result))backoff.pause();
+            }
+        }
+    }catch(...){
+        stop = true;
+        planner.join();
+        throw;
+    }
+    planner.join();
+    // a step that was ready had its planning time hidden behind the simulator
+    std::cerr << "async: " << ready << " of " << steps << " steps ready when needed, planning "
+              << busy_ns/1e3 << " us, main thread waited " << stall_ns/1e3 << " us\n";
+}
+
+void rw2group6::Algorithm::plan_follow_wall(int first_dir, int x, int y, int dir, int moves,
+        SpscQueue<PlanCommand,64>& commands, SpscQueue<SenseResult,2>& senses,
+        std::atomic<bool>& stop, double& busy_ns){
+    using clock = std::chrono::steady_clock;
+    auto busy_start = clock::now();
+    auto pause = [&](){busy_ns += std::chrono::duration<double,std::nano>(clock::now()-busy_start).count();};
+    // queue a step, waiting while the main thread is behind
+    auto send = [&](PlanCommand command){
+        Backoff backoff;
+        while(!commands.push(command)){
+            if(stop)return false;
+            backoff.pause();
+        }
+        return true;
+    };
+    // make sure the walls of mask (bits 0/1/2: left/front/right) are in the local
+    // map, the main thread senses the unknown ones. this is the only place the
+    // planner waits
+    auto sense = [&](int mask){
+        for(int i{0};i<3;i++){
+            if(m_maze[y][x].is_wall(calculate_dir(dir,i-1))!=-1)mask &= ~(1<<i);
+        }
+        if(mask==0)return true;
+        if(!send({PlanStep::sense,mask}))return false;
+        pause();
+        SenseResult result{};
+        Backoff backoff;
+        while(!senses.pop(result)){
+            if(stop)return false;
+            backoff.pause();
+        }
+        busy_start = clock::now();
+        for(int i{0};i<3;i++){
+            if(mask>>i & 1)store_wall(x,y,calculate_dir(dir,i-1),result.walls[i]==1);
+        }
+        return true;
+    };
+    bool stopped{false};
+    auto wall = [&](int lfr){
+        if(m_lazy_sensing && !sense(1<<(lfr+1)))stopped = true;
+        return m_maze[y][x].is_wall(calculate_dir(dir,lfr));
+    };
+    int const all_lfr{7};
+
+    if(!m_lazy_sensing && !sense(all_lfr))return;
+    while(x!=m_goal_x || y!=m_goal_y){
+        if(m_first_visit[y][x]==0)m_first_visit[y][x] = moves;
+        int turn{follow_turn(first_dir,wall)};
+        if(stopped)return;
+        if(turn!=0){
+            if(!send({PlanStep::turn,turn}))return;
+            dir = calculate_dir(dir,turn);
+        }
+        if(turn!=2){
+            if(!send({PlanStep::move,0}))return;
+            x += dir_x.at(dir);
+            y += dir_y.at(dir);
+            moves++;
+            store_wall(x,y,calculate_dir(dir,2),false);
+            if(!m_lazy_sensing && !sense(all_lfr))return;
+        }
+    }
+    if(m_first_visit[y][x]==0)m_first_visit[y][x] = moves;
+    pause();
+    send({PlanStep::done,0});
+}
+
+void rw2group6::Algorithm::set_shortcuts(bool shortcuts){
+    m_shortcuts = shortcuts;
+}
+
+int rw2group6::Algorithm::get_moves_saved(){
+    return m_moves_saved;
+}
+
+int rw2group6::Algorithm::predict_known_follow(int first_dir, int& x, int& y, int& dir){
+    // the rule only depends on the location and direction, so after more
+    // steps than there are of those it is going around in circles
+    long long const max_steps{4LL*m_maze_width*m_maze_height};
+    int moves{0};
+    for(long long step{0};x!=m_goal_x || y!=m_goal_y;step++){
+        if(step>max_steps)return -1;
+        // stop at the first unknown wall
+        int turn{follow_turn(first_dir,[&](int lfr){return m_maze[y][x].is_wall(calculate_dir(dir,lfr));})};
+        if(turn==-2)return moves;
+        dir = calculate_dir(dir,turn);
+        if(turn!=2){
+            x += dir_x.at(dir);
+            y += dir_y.at(dir);
+            moves++;
+        }
+    }
+    return moves;
+}
+
+void rw2group6::Algorithm::follow_wall_shortcut(std::string left_right_follow){
+    char color{'c'};
+    int first_dir{rule2first_dir(left_right_follow)};
+    if(!m_lazy_sensing)detect_wall_lfr(m_mouse.get_dir(),m_mouse.get_x(),m_mouse.get_y());
+    while(m_mouse.get_x()!=m_goal_x || m_mouse.get_y()!=m_goal_y){
+        update_first_vist();
+        int x{m_mouse.get_x()};
+        int y{m_mouse.get_y()};
+        int dir{m_mouse.get_dir()};
+        int predicted{predict_known_follow(first_dir,x,y,dir)};
+        if(predicted<0){
+            throw std::runtime_error("goal not reachable by wall following");
+        }
+        std::vector<int> path;
+        // if the rule only goes through explored cells for the next moves,
+        // take the shortest known path to where it leaves them. otherwise
+        // (or if no known path is found) take one step of plain wall following
+        if(predicted>1 && plan_known_path(x,y,path)){
+            for(int d : path){
+                move_to_dir(d,color);
+                update_back_wall(false);
+                update_first_vist();
+            }
+            // at the goal the heading no longer matters
+            if(x!=m_goal_x || y!=m_goal_y)turn_to_dir(dir);
+            m_moves_saved += predicted-static_cast<int>(path.size());
+            if(!m_lazy_sensing)detect_wall_lfr(m_mouse.get_dir(),m_mouse.get_x(),m_mouse.get_y());
+            continue;
+        }
+        follow_wall_step(first_dir,color);
+    }
+    update_first_vist();
+}
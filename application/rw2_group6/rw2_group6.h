@@ -4,6 +4,10 @@
 #include <array>
 #include <unordered_map>
 #include <string>
+#include <vector>
+#include <atomic>
+#include <functional>
+#include "spsc_queue.h"
 
 /**
  * @brief 
@@ -65,6 +69,19 @@ class Mouse{
      * @return m_moves
      */
     int get_moves();
+    /**
+     * @brief Set the number of moves, used when the move count is
+     * restored from a saved map
+     * 
+     * @param moves the number of moves
+     */
+    void set_moves(int moves);
+    /**
+     * @brief put the mouse back at (0,0) facing north, e.g., after the
+     * simulator was reset. m_moves is kept so that the first visit
+     * records stay ordered across runs
+     */
+    void reset_pose();
 
     private:
     /**
@@ -119,12 +136,47 @@ class Cell{
      */
     std::array<int,4> m_wall;
 }; // class Cell
+/**
+ * @brief kind of step sent by the planner thread in the asynchronous mode
+ */
+enum class PlanStep{turn, move, sense, done};
+
+/**
+ * @brief step sent from the planner thread to the main thread
+ */
+struct PlanCommand{
+    /**
+     * @brief kind of step
+     */
+    PlanStep type;
+    /**
+     * @brief turn: the amount to turn (see Mouse::turn()),
+     * sense: bits 0/1/2 set to query the left/front/right wall
+     */
+    int value;
+};
+
+/**
+ * @brief walls sensed by the main thread for the planner thread
+ */
+struct SenseResult{
+    /**
+     * @brief left/front/right wall: 1 wall, 0 no wall, -1 not queried
+     */
+    std::array<int,3> walls;
+};
+
 class Algorithm{
     public:
     /**
      * @brief Construct a new Algorithm object
+     * 
+     * @param width maze width (number of cells along x)
+     * @param height maze height (number of cells along y)
      */
-    Algorithm(): m_first_visit{0}{};
+    Algorithm(int width = 16, int height = 16): m_maze_width{width},m_maze_height{height},
+        m_maze(height,std::vector<Cell>(width)),m_first_visit(height,std::vector<int>(width,0)),
+        m_runs{0},m_wall_queries{0},m_async{false},m_lazy_sensing{false},m_shortcuts{false},m_moves_saved{0}{};
     /**
      * @brief initialize the maze, i.e., color outer walls
      */
@@ -135,6 +187,63 @@ class Algorithm{
      * @param left_right_follow indicates which rule: left/right
      */
     void follow_wall(std::string left_right_follow);
+    /**
+     * @brief same moves as follow_wall(), but the decisions are made by a
+     * planner thread that runs ahead on the local map while the main thread
+     * waits on the simulator. the planner only waits when a wall it needs is
+     * unknown. reports how many steps were already planned when needed
+     * @param left_right_follow indicates which rule: left/right
+     */
+    void follow_wall_async(std::string left_right_follow);
+    /**
+     * @brief select follow_wall_async() instead of follow_wall() in run()
+     * 
+     * @param async true for the asynchronous mode
+     */
+    void set_async(bool async);
+    /**
+     * @brief with lazy sensing, follow_wall() does not detect the left, front
+     * and right walls at every new location: check_wall() queries a wall only
+     * when the decision needs it, other walls stay unknown in the local map
+     * 
+     * @param lazy true for lazy sensing
+     */
+    void set_lazy_sensing(bool lazy);
+    /**
+     * @brief wall following that shortcuts the cells it already explored. at
+     * every step the rule is played ahead on the local map until it needs an
+     * unknown wall (or reaches the goal); the mouse takes the shortest known
+     * path to that location and direction instead. the rule then continues
+     * exactly as follow_wall() would, so the goal is reached whenever
+     * follow_wall() reaches it, with fewer or the same moves
+     * @param left_right_follow indicates which rule: left/right
+     */
+    void follow_wall_shortcut(std::string left_right_follow);
+    /**
+     * @brief play the wall following rule ahead on the local map, without moving
+     * 
+     * @param first_dir the first direction to check, -1 left, 1 right
+     * @param x x coordinate, updated to where the rule needs an unknown wall
+     * or reaches the goal
+     * @param y y coordinate, updated the same way
+     * @param dir direction of the mouse, updated the same way
+     * @return number of moves played, -1 if the rule loops on known cells
+     * and never reaches the goal
+     */
+    int predict_known_follow(int first_dir, int& x, int& y, int& dir);
+    /**
+     * @brief select follow_wall_shortcut() instead of follow_wall() in run()
+     * 
+     * @param shortcuts true to shortcut explored cells
+     */
+    void set_shortcuts(bool shortcuts);
+    /**
+     * @brief Get the number of moves saved by follow_wall_shortcut()
+     * compared with plain wall following
+     * 
+     * @return m_moves_saved
+     */
+    int get_moves_saved();
 
     /**
      * @brief generates the goal position in the maze. needs to be
@@ -142,13 +251,32 @@ class Algorithm{
      */
     void generate_goal();
     /**
-     * @brief check if there is wall in a certain direction
+     * @brief set the goal position instead of generating it, e.g., for
+     * batch runs over a list of goals
+     * 
+     * @param x x coordinate of the goal location
+     * @param y y coordinate of the goal location
+     */
+    void set_goal(int x, int y);
+    /**
+     * @brief check if there is wall in a certain direction. with lazy
+     * sensing, an unknown wall is queried from the simulator
      * 
      * @param flr the direction to be checked (front/left/right)
      * @return true if there is a wall
      * @return false if there is no wall
      */
     bool check_wall(int flr);
+    /**
+     * @brief query the simulator for a wall and store it in the local map
+     * 
+     * @param dir current direction of the mouse
+     * @param x x coordinate of the mouse
+     * @param y y coordinate of the mouse
+     * @param lfr relative direction: -1 left, 0 front, 1 right
+     * @return true if there is a wall
+     */
+    bool sense_wall(int dir, int x, int y, int lfr);
     
     /**
      * @brief direct the mouse back to the initial position
@@ -172,6 +300,16 @@ class Algorithm{
      * @param is_wall true for wall, false for no wall
      */
     void update_back_wall(bool is_wall);
+    /**
+     * @brief store a wall in the local map, in the cell and in the
+     * neighbor cell on the other side of the wall
+     * 
+     * @param x x coordinate of the cell
+     * @param y y coordinate of the cell
+     * @param dir absolute direction (0-3, mapped from n/e/s/w)
+     * @param is_wall true for wall, false for no wall
+     */
+    void store_wall(int x, int y, int dir, bool is_wall);
     /**
      * @brief map from the relative direction (front, left, right)
      * to absolute direction (north, west, south, east) based on the
@@ -181,6 +319,105 @@ class Algorithm{
      * @return absolute direction as an int (0-3, mapped from n/e/s/w)
      */
     static int calculate_dir(int dir, int flr);
+    /**
+     * @brief the decision of the wall following rule at one location: turn
+     * towards first_dir if there is no wall, otherwise go straight, otherwise
+     * turn the other way, otherwise turn around
+     * 
+     * @param first_dir the first direction to check, -1 left, 1 right
+     * @param wall returns the wall in a relative direction (-1 left, 0 front,
+     * 1 right): 1 wall, 0 no wall, -1 unknown
+     * @return the amount to turn (see Mouse::turn()), 2 to turn around without
+     * moving, -2 if the decision needs an unknown wall
+     */
+    static int follow_turn(int first_dir, const std::function<int(int)>& wall);
+    /**
+     * @brief the first direction to check for a wall following rule
+     * 
+     * @param left_right_follow indicates which rule: left/right
+     * @return -1 for left, 1 for right
+     */
+    static int rule2first_dir(const std::string& left_right_follow);
+
+    /**
+     * @brief one run: go to the goal and back to (0,0). uses the route
+     * through the local map if one is known, otherwise wall following.
+     * if the goal can not be reached (std::runtime_error, e.g., from
+     * follow_wall_shortcut()), this is reported and the mouse stays where
+     * it is until the next reset
+     * 
+     * @param left_right_follow indicates which rule: left/right
+     */
+    void run(std::string left_right_follow);
+    /**
+     * @brief prepare a new run after the simulator was reset. the local
+     * map and the first visit records are kept
+     */
+    void reset_run();
+    /**
+     * @brief check if the local map knows the passage between (x,y) and
+     * its neighbor in direction dir is open
+     * 
+     * @param x x coordinate of the cell
+     * @param y y coordinate of the cell
+     * @param dir absolute direction (0-3, mapped from n/e/s/w)
+     * @return true if the passage is known to be open
+     * @return false if there is a wall or the wall is unknown
+     */
+    bool is_known_open(int x, int y, int dir);
+    /**
+     * @brief find the shortest path from the current location of the mouse
+     * to (x_goal,y_goal) through passages known to be open (BFS)
+     * 
+     * @param x_goal x coordinate of the target location
+     * @param y_goal y coordinate of the target location
+     * @param path absolute direction (0-3) of each move of the path
+     * @return true if a path was found
+     */
+    bool plan_known_path(int x_goal, int y_goal, std::vector<int>& path);
+    /**
+     * @brief drive the mouse to the goal along the shortest known path
+     * 
+     * @return true if the goal was reached
+     * @return false if the local map has no known path to the goal
+     */
+    bool follow_known_path();
+    /**
+     * @brief turn the mouse towards an absolute direction and move forward by 1
+     * 
+     * @param dir absolute direction (0-3, mapped from n/e/s/w)
+     * @param color the color to set for the maze when the mouse moves
+     */
+    void move_to_dir(int dir, char color);
+    /**
+     * @brief turn the mouse towards an absolute direction, without moving
+     * 
+     * @param dir absolute direction (0-3, mapped from n/e/s/w)
+     */
+    void turn_to_dir(int dir);
+    /**
+     * @brief write the goal, the local map and the first visit records to a file
+     * 
+     * @param file_name path of the file
+     * @return true if the file was written
+     */
+    bool save_map(const std::string& file_name);
+    /**
+     * @brief restore the goal, the local map and the first visit records
+     * from a file written by save_map(), and draw the known walls. only the
+     * maze size is checked: the known walls are trusted without sensing, so
+     * the file must have been saved on the same maze
+     * 
+     * @param file_name path of the file
+     * @return true if the file was read and matches the maze size
+     */
+    bool load_map(const std::string& file_name);
+    /**
+     * @brief Get the memory used by the local map and the first visit records
+     * 
+     * @return size in bytes
+     */
+    std::size_t get_map_bytes();
 
     /**
      * @brief creates a mapping between nesw as chars to 0-3 as int
@@ -193,21 +430,54 @@ class Algorithm{
      * @brief creates a mapping between int (0-3) to char (n/e/s/w)
      */
     static std::string int2dir;
+    /**
+     * @brief x offset of a move in each absolute direction (0-3, mapped from n/e/s/w)
+     */
+    static const std::array<int,4> dir_x;
+    /**
+     * @brief y offset of a move in each absolute direction (0-3, mapped from n/e/s/w)
+     */
+    static const std::array<int,4> dir_y;
 
     private:
     /**
-     * @brief the maze size width is defined as a static const int 
+     * @brief one step of follow_wall() from the current location: decide with
+     * follow_turn(), turn, and move forward unless the mouse turned around
+     * 
+     * @param first_dir the first direction to check, -1 left, 1 right
+     * @param color the color to set for the maze when the mouse moves
+     */
+    void follow_wall_step(int first_dir, char color);
+    /**
+     * @brief the planner thread of follow_wall_async(). it owns the local map and
+     * the first visit records until it sends PlanStep::done
+     * 
+     * @param first_dir the first direction to check, -1 left, 1 right
+     * @param x x coordinate of the mouse when the planner starts
+     * @param y y coordinate of the mouse when the planner starts
+     * @param dir direction of the mouse when the planner starts
+     * @param moves number of moves of the mouse when the planner starts
+     * @param commands steps to the main thread
+     * @param senses walls sensed by the main thread
+     * @param stop set by the main thread to stop the planner
+     * @param busy_ns time spent by the planner not waiting on the main thread
+     */
+    void plan_follow_wall(int first_dir, int x, int y, int dir, int moves,
+        SpscQueue<PlanCommand,64>& commands, SpscQueue<SenseResult,2>& senses,
+        std::atomic<bool>& stop, double& busy_ns);
+    /**
+     * @brief the maze width, set when the Algorithm object is constructed
      */
-    int static const m_maze_width{16};
+    int const m_maze_width;
     /**
-     * @brief the maze size height is defined as a static const int 
+     * @brief the maze height, set when the Algorithm object is constructed
      */
-    int static const m_maze_height{16};
+    int const m_maze_height;
     /**
      * @brief m_maze is an array of Cell objects that store the detected
      * walls. serves as a local map
      */
-    std::array<std::array<Cell,m_maze_width>,m_maze_height> m_maze;
+    std::vector<std::vector<Cell>> m_maze;
     /**
      * @brief the Mouse object that traverses the maze
      */
@@ -218,7 +488,7 @@ class Algorithm{
      * means that location (1,1) is first visted on the second move. the array will
      * be used to find the return path once the goal location is reached.
      */
-    std::array<std::array<int,m_maze_width>,m_maze_height> m_first_visit;
+    std::vector<std::vector<int>> m_first_visit;
     /**
      * @brief x coordinate of the goal location
      */
@@ -227,6 +497,30 @@ class Algorithm{
      * @brief y coordinate of the goal location
      */
     int m_goal_y; 
+    /**
+     * @brief number of runs started since the program was launched
+     */
+    int m_runs;
+    /**
+     * @brief number of wall queries sent to the simulator
+     */
+    int m_wall_queries;
+    /**
+     * @brief true to use follow_wall_async() in run()
+     */
+    bool m_async;
+    /**
+     * @brief true to sense walls only when a decision needs them
+     */
+    bool m_lazy_sensing;
+    /**
+     * @brief true to use follow_wall_shortcut() in run()
+     */
+    bool m_shortcuts;
+    /**
+     * @brief number of moves saved by follow_wall_shortcut()
+     */
+    int m_moves_saved;
 }; // class Algorithm
 
 } // namespace rw2group6
@@ -0,0 +1,93 @@
+#ifndef __SPSC_QUEUE_H__
+#define __SPSC_QUEUE_H__
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <thread>
+
+/**
+ * @brief lock-free queue between exactly one producer thread and one
+ * consumer thread (ring buffer, one slot is kept empty)
+ */
+#pragma once
+namespace rw2group6{
+
+template <typename T, std::size_t Capacity>
+class SpscQueue{
+    public:
+    /**
+     * @brief add an item, only called by the producer thread
+     * 
+     * @param item the item to add
+     * @return false if the queue is full
+     */
+    bool push(const T& item){
+        std::size_t tail{m_tail.load(std::memory_order_relaxed)};
+        std::size_t next{(tail+1)%Capacity};
+        if(next==m_head.load(std::memory_order_acquire))return false;
+        m_items[tail] = item;
+        m_tail.store(next,std::memory_order_release);
+        return true;
+    }
+    /**
+     * @brief remove the oldest item, only called by the consumer thread
+     * 
+     * @param item set to the removed item
+     * @return false if the queue is empty
+     */
+    bool pop(T& item){
+        std::size_t head{m_head.load(std::memory_order_relaxed)};
+        if(head==m_tail.load(std::memory_order_acquire))return false;
+        item = m_items[head];
+        m_head.store((head+1)%Capacity,std::memory_order_release);
+        return true;
+    }
+
+    private:
+    /**
+     * @brief m_items stores the items of the ring buffer
+     */
+    std::array<T,Capacity> m_items{};
+    /**
+     * @brief m_head is the index of the next item to pop, written by the consumer
+     */
+    alignas(64) std::atomic<std::size_t> m_head{0};
+    /**
+     * @brief m_tail is the index of the next free slot, written by the producer
+     */
+    alignas(64) std::atomic<std::size_t> m_tail{0};
+}; // class SpscQueue
+
+/**
+ * @brief waits between polls of an empty/full SpscQueue: yields for the
+ * first polls, which covers a short handoff, then sleeps so that a thread
+ * waiting on a simulator round trip does not keep a core busy
+ */
+class Backoff{
+    public:
+    /**
+     * @brief wait before the next poll
+     */
+    void pause(){
+        if(m_polls<m_spin_polls){
+            m_polls++;
+            std::this_thread::yield();
+        }else{
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+        }
+    }
+
+    private:
+    /**
+     * @brief number of polls that only yield before sleeping
+     */
+    static const int m_spin_polls{64};
+    /**
+     * @brief m_polls is the number of polls so far
+     */
+    int m_polls{0};
+}; // class Backoff
+
+} // namespace rw2group6
+#endif
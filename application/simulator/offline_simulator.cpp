@@ -0,0 +1,92 @@
+#include "simulator.h"
+#include "offline_simulator.h"
+#include <array>
+#include <stdexcept>
+
+namespace {
+rw2group6::Maze maze;
+int robot_x{0};
+int robot_y{0};
+int robot_dir{0};  // 'n','e','s','w' as 0,1,2,3
+int move_count{0};
+int query_count{0};
+int move_limit{0};
+
+bool wallAt(int turn) {
+  ++query_count;
+  return maze.is_wall(robot_x, robot_y, (robot_dir + turn + 4) % 4);
+}
+}  // namespace
+
+void OfflineSimulator::load(const rw2group6::Maze& m) {
+  maze = m;
+  reset();
+}
+
+void OfflineSimulator::reset() {
+  robot_x = 0;
+  robot_y = 0;
+  robot_dir = 0;
+  move_count = 0;
+  query_count = 0;
+}
+
+void OfflineSimulator::setMoveLimit(int limit) { move_limit = limit; }
+
+int OfflineSimulator::moves() { return move_count; }
+
+int OfflineSimulator::wallQueries() { return query_count; }
+
+int OfflineSimulator::x() { return robot_x; }
+
+int OfflineSimulator::y() { return robot_y; }
+
+int Simulator::mazeWidth() { return maze.get_width(); }
+
+int Simulator::mazeHeight() { return maze.get_height(); }
+
+bool Simulator::wallFront() { return wallAt(0); }
+
+bool Simulator::wallRight() { return wallAt(1); }
+
+bool Simulator::wallLeft() { return wallAt(-1); }
+
+void Simulator::moveForward(int distance) {
+  static const std::array<int, 4> dir_x{0, 1, 0, -1};
+  static const std::array<int, 4> dir_y{1, 0, -1, 0};
+  for (int i{0}; i < distance; i++) {
+    if (maze.is_wall(robot_x, robot_y, robot_dir)) {
+      throw std::runtime_error("crash");
+    }
+    if (move_limit > 0 && move_count >= move_limit) {
+      throw std::runtime_error("move limit");
+    }
+    robot_x += dir_x[robot_dir];
+    robot_y += dir_y[robot_dir];
+    ++move_count;
+  }
+}
+
+void Simulator::turnRight() { robot_dir = (robot_dir + 1) % 4; }
+
+void Simulator::turnLeft() { robot_dir = (robot_dir + 3) % 4; }
+
+void Simulator::setWall(int, int, char) {}
+
+void Simulator::clearWall(int, int, char) {}
+
+void Simulator::setColor(int, int, char) {}
+
+void Simulator::clearColor(int, int) {}
+
+void Simulator::clearAllColor() {}
+
+void Simulator::setText(int, int, const std::string&) {}
+
+void Simulator::clearText(int, int) {}
+
+void Simulator::clearAllText() {}
+
+bool Simulator::wasReset() { return false; }
+
+void Simulator::ackReset() { OfflineSimulator::reset(); }
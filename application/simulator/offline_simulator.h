@@ -0,0 +1,55 @@
+#ifndef __OFFLINE_SIMULATOR_H__
+#define __OFFLINE_SIMULATOR_H__
+
+/**
+ * @file offline_simulator.h
+ * @brief Maze loaded from a file in place of the mms simulator, for batch
+ * runs of the solver. Link simulator/offline_simulator.cpp instead of
+ * simulator/simulator.cpp: the Simulator functions then answer from the
+ * loaded maze without any stdin/stdout round trip, and drawing calls
+ * (walls, colors, text) do nothing.
+ */
+#pragma once
+
+#include "..\rw2_group6\maze.h"
+
+class OfflineSimulator {
+ public:
+  /**
+   * @brief Load the maze the Simulator functions answer from, and reset
+   * the robot and the counters.
+   *
+   * @param maze Maze to simulate.
+   */
+  static void load(const rw2group6::Maze& maze);
+  /**
+   * @brief Put the robot back at (0,0) facing north and clear the counters.
+   */
+  static void reset();
+  /**
+   * @brief Set the maximum number of moves of a run. moveForward throws
+   * std::runtime_error past that limit, e.g., when the goal can not be
+   * reached by wall following.
+   *
+   * @param limit Maximum number of moves, 0 for no limit.
+   */
+  static void setMoveLimit(int limit);
+  /**
+   * @brief Number of cells moved since the last reset.
+   */
+  static int moves();
+  /**
+   * @brief Number of wallFront/wallLeft/wallRight calls since the last reset.
+   */
+  static int wallQueries();
+  /**
+   * @brief X coordinate of the robot.
+   */
+  static int x();
+  /**
+   * @brief Y coordinate of the robot.
+   */
+  static int y();
+};
+
+#endif
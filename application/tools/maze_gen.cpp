@@ -0,0 +1,27 @@
+#include "..\rw2_group6\maze.h"
+#include "..\rw2_group6\maze_generator.h"
+#include <iostream>
+#include <string>
+
+int main(int argc, char* argv[]){
+    if(argc<5){
+        std::cerr << "usage: maze_gen <width> <height> <seed> <output file> [loop density 0-1] [straightness 0-1]\n";
+        return 1;
+    }
+    int width{std::stoi(argv[1])};
+    int height{std::stoi(argv[2])};
+    unsigned int seed{static_cast<unsigned int>(std::stoul(argv[3]))};
+    std::string file{argv[4]};
+    double loop_density{argc>5 ? std::stod(argv[5]) : 0.0};
+    double straightness{argc>6 ? std::stod(argv[6]) : 0.5};
+    if(width<1 || height<1){
+        std::cerr << "width and height must be at least 1\n";
+        return 1;
+    }
+    rw2group6::MazeGenerator generator(seed);
+    if(!generator.generate(width,height,loop_density,straightness).save(file)){
+        std::cerr << "could not write " << file << "\n";
+        return 1;
+    }
+    return 0;
+}
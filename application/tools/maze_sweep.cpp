@@ -0,0 +1,139 @@
+#include "..\simulator\simulator.h"
+#include "..\simulator\offline_simulator.h"
+#include "..\rw2_group6\rw2_group6.h"
+#include "..\rw2_group6\maze.h"
+#include "..\rw2_group6\maze_symmetry.h"
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * @brief solve one case with the wall follower on the offline simulator,
+ * with follow_wall_async() if async is set, then return to (0,0)
+ */
+rw2group6::SolveResult solve(const rw2group6::Maze& maze, int goal_x, int goal_y, const std::string& rule,
+        bool lazy, bool async){
+    OfflineSimulator::load(maze);
+    auto solver = std::make_unique<rw2group6::Algorithm>();
+    solver->set_lazy_sensing(lazy);
+    solver->init_maze();
+    solver->set_goal(goal_x,goal_y);
+    bool reached{true};
+    int moves{0};
+    int wall_queries{0};
+    try{
+        if(async)solver->follow_wall_async(rule);
+        else solver->follow_wall(rule);
+        moves = OfflineSimulator::moves();
+        wall_queries = OfflineSimulator::wallQueries();
+        solver->return_to_init_loc();
+    }catch(const std::runtime_error&){
+        reached = false; // goal not reachable by wall following
+        moves = OfflineSimulator::moves();
+        wall_queries = OfflineSimulator::wallQueries();
+    }
+    return {reached,moves,wall_queries,OfflineSimulator::wallQueries()};
+}
+
+int main(int argc, char* argv[]){
+    // sweep every (maze, goal, rule) case over the given 16x16 maze files, e.g.
+    // maze_sweep ../mazefiles/classic/*.txt
+    // --verify also solves the cases found in the cache and compares the results
+    // --lazy senses walls only when the wall follower needs them
+    // --async solves with the planner thread and checks every case against
+    // the same case solved by follow_wall()
+    bool verify{false};
+    bool lazy{false};
+    bool async{false};
+    std::vector<std::string> files;
+    for(int i{1};i<argc;i++){
+        std::string arg{argv[i]};
+        if(arg=="--verify")verify = true;
+        else if(arg=="--lazy")lazy = true;
+        else if(arg=="--async")async = true;
+        else files.push_back(arg);
+    }
+    int const maze_size{16};
+    OfflineSimulator::setMoveLimit(100*maze_size*maze_size);
+
+    // mazes that are identical or rotations/mirrors of each other
+    std::map<std::string,std::vector<std::string>> groups;
+    rw2group6::SolveCache cache;
+    int cases{0};
+    int reached{0};
+    long long wall_queries{0};
+    long long run_wall_queries{0};
+    int mismatches{0};
+    int async_mismatches{0};
+    auto start = std::chrono::steady_clock::now();
+    for(const auto& file : files){
+        rw2group6::Maze maze;
+        if(!maze.load(file) || maze.get_width()!=maze_size || maze.get_height()!=maze_size){
+            std::cerr << "skipped " << file << "\n";
+            continue;
+        }
+        groups[rw2group6::MazeSymmetry::canonical_maze(maze)].push_back(file);
+        // goals along the outer wall other than (0,0), as in generate_goal()
+        for(int y{0};y<maze_size;y++){
+            for(int x{0};x<maze_size;x++){
+                bool outer{x==0 || y==0 || x==maze_size-1 || y==maze_size-1};
+                if(!outer || (x==0 && y==0))continue;
+                for(std::string rule : {"left","right"}){
+                    cases++;
+                    std::string key{rw2group6::MazeSymmetry::canonical_case(maze,0,0,0,x,y,rule)};
+                    rw2group6::SolveResult result{};
+                    if(cache.find(key,result)){
+                        if(verify){
+                            auto check = solve(maze,x,y,rule,lazy,async);
+                            if(check.reached!=result.reached || check.moves!=result.moves
+                                || check.wall_queries!=result.wall_queries
+                                || check.run_wall_queries!=result.run_wall_queries)mismatches++;
+                        }
+                    }else{
+                        result = solve(maze,x,y,rule,lazy,async);
+                        cache.insert(key,result);
+                        if(async){
+                            auto check = solve(maze,x,y,rule,lazy,false);
+                            if(check.reached!=result.reached || check.moves!=result.moves
+                                || check.wall_queries!=result.wall_queries
+                                || check.run_wall_queries!=result.run_wall_queries)async_mismatches++;
+                        }
+                    }
+                    if(result.reached){
+                        reached++;
+                        wall_queries += result.wall_queries;
+                        run_wall_queries += result.run_wall_queries;
+                    }
+                }
+            }
+        }
+    }
+    double seconds{std::chrono::duration<double>(std::chrono::steady_clock::now()-start).count()};
+
+    int duplicates{0};
+    for(const auto& [canonical,members] : groups){
+        if(members.size()<2)continue;
+        duplicates += static_cast<int>(members.size())-1;
+        std::cout << std::hex << rw2group6::MazeSymmetry::hash(canonical) << std::dec << ":";
+        for(const auto& m : members)std::cout << " " << m;
+        std::cout << "\n";
+    }
+    int lookups{cache.get_hits()+cache.get_misses()};
+    std::cout << "mazes: " << groups.size()+duplicates << ", distinct up to symmetry: " << groups.size() << "\n";
+    std::cout << "cases: " << cases << ", reached goal: " << reached << "\n";
+    std::cout << "wall queries to goal: " << wall_queries << " ("
+              << (reached>0 ? static_cast<double>(wall_queries)/reached : 0.0) << " per case, "
+              << (lazy ? "lazy" : "eager") << " sensing" << (async ? ", async" : "") << ")\n";
+    std::cout << "wall queries per run (goal and back): " << run_wall_queries << " ("
+              << (reached>0 ? static_cast<double>(run_wall_queries)/reached : 0.0) << " per case)\n";
+    std::cout << "solved: " << cache.get_misses() << ", from cache: " << cache.get_hits()
+              << " (hit rate " << (lookups>0 ? 100.0*cache.get_hits()/lookups : 0.0) << "%)\n";
+    std::cout << "time: " << seconds << " s\n";
+    if(verify)std::cout << "verify mismatches: " << mismatches << "\n";
+    if(async)std::cout << "async mismatches with follow_wall: " << async_mismatches << "\n";
+    return mismatches==0 && async_mismatches==0 ? 0 : 1;
+}
@@ -0,0 +1,97 @@
+#include "..\simulator\simulator.h"
+#include "..\simulator\offline_simulator.h"
+#include "..\rw2_group6\rw2_group6.h"
+#include "..\rw2_group6\maze.h"
+#include "..\rw2_group6\maze_generator.h"
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+int main(int argc, char* argv[]){
+    // time per move and memory per cell of the solver on generated square
+    // mazes of growing size, averaged over several seeds. the number of moves
+    // depends a lot on the maze, so time is divided by moves: a growing time
+    // per move shows superlinear behavior. every seed is solved for 5 goals
+    // (see below), the failed column counts the (seed, goal) cases not solved
+    // scaling_bench [loop density 0-1] [straightness 0-1] [first seed] [seeds]
+    double loop_density{argc>1 ? std::stod(argv[1]) : 0.0};
+    double straightness{argc>2 ? std::stod(argv[2]) : 0.5};
+    unsigned int first_seed{argc>3 ? static_cast<unsigned int>(std::stoul(argv[3])) : 1U};
+    int seeds{argc>4 ? std::stoi(argv[4]) : 5};
+    std::vector<int> sizes{16,32,64,128,256,512,1024};
+
+    std::cout << std::setw(6) << "size" << std::setw(10) << "moves/c"
+              << std::setw(12) << "follow ns/m" << std::setw(12) << "return ns/m"
+              << std::setw(10) << "bytes/c" << std::setw(8) << "failed";
+    // moves per cell to each goal and back
+    for(std::string goal : {"top","right","bottom","left","corner"})std::cout << std::setw(8) << goal;
+    std::cout << "\n";
+    for(int size : sizes){
+        double cells{static_cast<double>(size)*size};
+        double follow_ns{0};
+        double return_ns{0};
+        long long follow_moves{0};
+        long long return_moves{0};
+        double bytes{0};
+        int solved{0};
+        // goals along the outer wall: the middle of each wall and the far
+        // corner. with loops the rule may reach the corner along the outer
+        // wall alone, the other goals need more of the maze explored
+        std::vector<std::pair<int,int>> goals{{size/2,size-1},{size-1,size/2},{size/2,0},
+            {0,size/2},{size-1,size-1}};
+        std::vector<long long> goal_moves(goals.size(),0);
+        std::vector<int> goal_solved(goals.size(),0);
+        for(int k{0};k<seeds;k++){
+            rw2group6::MazeGenerator generator(first_seed+k);
+            auto maze = generator.generate(size,size,loop_density,straightness);
+            for(std::size_t g{0};g<goals.size();g++){
+                auto [goal_x,goal_y] = goals[g];
+                OfflineSimulator::load(maze);
+                OfflineSimulator::setMoveLimit(static_cast<int>(16*cells));
+                auto solver = std::make_unique<rw2group6::Algorithm>(size,size);
+                solver->init_maze();
+                solver->set_goal(goal_x,goal_y);
+                try{
+                    auto start = std::chrono::steady_clock::now();
+                    solver->follow_wall("right");
+                    auto middle = std::chrono::steady_clock::now();
+                    int moves{OfflineSimulator::moves()};
+                    solver->return_to_init_loc();
+                    auto end = std::chrono::steady_clock::now();
+                    follow_ns += std::chrono::duration<double,std::nano>(middle-start).count();
+                    return_ns += std::chrono::duration<double,std::nano>(end-middle).count();
+                    follow_moves += moves;
+                    return_moves += OfflineSimulator::moves()-moves;
+                    bytes += static_cast<double>(solver->get_map_bytes());
+                    solved++;
+                    goal_moves[g] += OfflineSimulator::moves();
+                    goal_solved[g]++;
+                }catch(const std::runtime_error&){
+                    // counted in the failed column
+                }
+            }
+        }
+        std::cout << std::setw(6) << size;
+        if(solved>0){
+            std::cout << std::fixed << std::setprecision(1)
+                      << std::setw(10) << (follow_moves+return_moves)/(cells*solved)
+                      << std::setw(12) << (follow_moves>0 ? follow_ns/follow_moves : 0.0)
+                      << std::setw(12) << (return_moves>0 ? return_ns/return_moves : 0.0)
+                      << std::setw(10) << bytes/(cells*solved);
+        }else{
+            std::cout << std::setw(10) << "-" << std::setw(12) << "-" << std::setw(12) << "-" << std::setw(10) << "-";
+        }
+        std::cout << std::setw(8) << seeds*static_cast<int>(goals.size())-solved;
+        for(std::size_t g{0};g<goals.size();g++){
+            if(goal_solved[g]>0)std::cout << std::fixed << std::setprecision(2) << std::setw(8) << goal_moves[g]/(cells*goal_solved[g]);
+            else std::cout << std::setw(8) << "-";
+        }
+        std::cout << "\n";
+    }
+    return 0;
+}
@@ -0,0 +1,100 @@
+#include "..\simulator\simulator.h"
+#include "..\simulator\offline_simulator.h"
+#include "..\rw2_group6\rw2_group6.h"
+#include "..\rw2_group6\maze.h"
+#include <array>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+/**
+ * @brief moves to the goal with plain or shortcut wall following on the
+ * offline simulator, -1 if the goal is not reached. with warm set, the
+ * mouse first explores to the opposite corner with plain wall following
+ * and returns to (0,0), and the local map is kept, as with several goals
+ * in one session
+ */
+int moves_to_goal(const rw2group6::Maze& maze, int goal_x, int goal_y, const std::string& rule,
+        bool shortcuts, bool warm){
+    int width{maze.get_width()};
+    int height{maze.get_height()};
+    OfflineSimulator::load(maze);
+    auto solver = std::make_unique<rw2group6::Algorithm>(width,height);
+    solver->init_maze();
+    int moves{0};
+    try{
+        if(warm){
+            solver->set_goal(width-1,height-1);
+            solver->follow_wall(rule);
+            solver->return_to_init_loc();
+            moves = OfflineSimulator::moves();
+        }
+        solver->set_goal(goal_x,goal_y);
+        if(shortcuts)solver->follow_wall_shortcut(rule);
+        else solver->follow_wall(rule);
+    }catch(const std::runtime_error&){
+        return -1;
+    }
+    return OfflineSimulator::moves()-moves;
+}
+
+int main(int argc, char* argv[]){
+    // moves to the goal of plain and shortcut wall following, per maze, summed
+    // over every goal along the outer wall that plain wall following reaches
+    // shortcut_compare [--warm] ../mazefiles/classic/*.txt
+    // --warm starts every run with the local map of a first run to the
+    // opposite corner, otherwise the runs start with an empty local map
+    bool warm{false};
+    int first_file{1};
+    if(argc>1 && std::string(argv[1])=="--warm"){
+        warm = true;
+        first_file = 2;
+    }
+    std::cout << std::setw(40) << std::left << "maze" << std::right
+              << std::setw(8) << "left" << std::setw(10) << "shortcut"
+              << std::setw(8) << "right" << std::setw(10) << "shortcut" << "\n";
+    std::array<long long,4> total{0,0,0,0};
+    int failures{0};
+    for(int i{first_file};i<argc;i++){
+        rw2group6::Maze maze;
+        if(!maze.load(argv[i])){
+            std::cerr << "skipped " << argv[i] << "\n";
+            continue;
+        }
+        int width{maze.get_width()};
+        int height{maze.get_height()};
+        OfflineSimulator::setMoveLimit(100*width*height);
+        std::array<long long,4> sum{0,0,0,0}; // left, left shortcut, right, right shortcut
+        for(int y{0};y<height;y++){
+            for(int x{0};x<width;x++){
+                bool outer{x==0 || y==0 || x==width-1 || y==height-1};
+                if(!outer || (x==0 && y==0))continue;
+                int r{0};
+                for(std::string rule : {"left","right"}){
+                    int plain{moves_to_goal(maze,x,y,rule,false,warm)};
+                    int shortcut{moves_to_goal(maze,x,y,rule,true,warm)};
+                    // the shortcut rule must reach every goal plain wall following reaches
+                    if(plain>=0 && (shortcut<0 || shortcut>plain))failures++;
+                    if(plain>=0 && shortcut>=0){
+                        sum[r] += plain;
+                        sum[r+1] += shortcut;
+                    }
+                    r += 2;
+                }
+            }
+        }
+        std::cout << std::setw(40) << std::left << argv[i] << std::right;
+        for(int k{0};k<4;k++){
+            std::cout << std::setw(k%2==0 ? 8 : 10) << sum[k];
+            total[k] += sum[k];
+        }
+        std::cout << "\n";
+    }
+    std::cout << std::fixed << std::setprecision(1)
+              << "moves saved: left " << (total[0]>0 ? 100.0*(total[0]-total[1])/total[0] : 0.0)
+              << "%, right " << (total[2]>0 ? 100.0*(total[2]-total[3])/total[2] : 0.0) << "%\n";
+    if(failures>0)std::cout << "shortcut worse than plain wall following: " << failures << " cases\n";
+    return failures==0 ? 0 : 1;
+}